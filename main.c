@@ -9,6 +9,21 @@
  
 #define MAX_TRACKS 100
 #define MAX_REQUESTS 1000
+#define MAX_ACTUATORS 8
+ 
+// Service time model used by the multi-actuator simulation
+#define SEEK_MS_PER_TRACK 0.15   // Head movement cost per track crossed
+#define REQUEST_OVERHEAD_MS 4.17 // Average rotational latency at 7200 RPM
+ 
+// Scheduling algorithm identifiers
+#define ALGO_FIFO 0
+#define ALGO_SSTF 1
+#define ALGO_SCAN 2
+#define ALGO_CSCAN 3
+#define NUM_ALGORITHMS 4
+ 
+// Display names indexed by the scheduling algorithm identifiers
+static const char *algorithm_names[NUM_ALGORITHMS] = {"FIFO", "SSTF", "SCAN", "C-SCAN"};
  
 // Struct to track request information for fairness analysis
 typedef struct {
@@ -18,6 +33,16 @@ typedef struct {
     int delay;          // Delay = service_order - entry_order
 } Request;
  
+// Struct to track the workload of one actuator (independent head stack)
+typedef struct {
+    int low_track;        // First track covered by this actuator
+    int high_track;       // Last track covered by this actuator
+    int request_count;    // Number of requests routed to this actuator
+    int tracks_traversed; // Total head movement of this actuator within its range
+    double stroke_tracks; // Head movement scaled to a full stroke of the platters
+    double busy_ms;       // Time this actuator spends servicing its requests
+} Actuator;
+ 
 // Function declarations
 void generate_requests(int m, int seed, const char *filename);
 void read_requests(const char *filename, int *requests, int *m);
@@ -27,21 +52,50 @@ int scan_scheduler(int *requests, int m, int initial_pos, Request *req_info);
 int c_scan_scheduler(int *requests, int m, int initial_pos, Request *req_info);
 void analyze_fairness(Request *req_info, int m);
 void print_histogram(Request *req_info, int m);
+int run_reference_scheduler(int algorithm, int *requests, int m, int initial_pos, Request *req_info);
+bool c_scan_wraps(int *requests, int m, int initial_pos);
+void simulate_actuators(int algorithm, int *requests, int m, int num_actuators, Actuator *actuators);
+void analyze_actuators(int *requests, int m, int num_actuators);
+bool tracks_in_range(int *requests, int m);
+void group_by_track(int *requests, int m, int *start, int *by_track);
+void record_service_order(int *requests, int m, int *service_order, Request *req_info);
+int sstf_fast_scheduler(int *requests, int m, Request *req_info);
+int scan_fast_scheduler(int *requests, int m, int initial_pos, Request *req_info);
+int c_scan_fast_scheduler(int *requests, int m, int initial_pos, Request *req_info);
+int run_scheduler(int algorithm, int *requests, int m, int initial_pos, Request *req_info);
+int compare_engines(int algorithm, int *requests, int m, int initial_pos);
+int check_schedule(int algorithm, int *requests, int m, int initial_pos);
+int verify_schedulers(int seed, int trials);
  
 /**
  * Main program entry point
  * Parses command line arguments, generates requests, and executes the disk
  * scheduling algorithms for comparison
  * 
- * Inputs: Command line arguments (number of requests and random seed)
+ * Inputs: Command line arguments (number of requests, random seed and
+ *         number of actuators), or "verify" followed by an optional seed and
+ *         number of random trials to run the scheduler self-checks
  * Outputs: Comparison of disk scheduling algorithm performance and fairness metrics
  */
 int main(int argc, char *argv[]) {
     int m = 100;  // Default number of requests
     int seed = time(NULL);  // Default seed is current time
+    int num_actuators = 1;  // Default is a single head stack
     int *requests;
     Request *req_info_fifo, *req_info_sstf, *req_info_scan, *req_info_cscan;
    
+    // Run the scheduler self-checks instead of a simulation
+    if (argc >= 2 && strcmp(argv[1], "verify") == 0) {
+        int trials = 200;
+        if (argc >= 3) {
+            seed = atoi(argv[2]);
+        }
+        if (argc >= 4) {
+            trials = atoi(argv[3]);
+        }
+        return verify_schedulers(seed, trials) == 0 ? 0 : 1;
+    }
+   
     // Check for command line arguments
     if (argc >= 2) {
         m = atoi(argv[1]);
@@ -49,6 +103,13 @@ int main(int argc, char *argv[]) {
     if (argc >= 3) {
         seed = atoi(argv[2]);
     }
+    if (argc >= 4) {
+        num_actuators = atoi(argv[3]);
+        if (num_actuators < 1 || num_actuators > MAX_ACTUATORS) {
+            printf("Number of actuators must be between 1 and %d\n", MAX_ACTUATORS);
+            return 1;
+        }
+    }
    
     printf("Generating %d random track requests with seed %d\n", m, seed);
     generate_requests(m, seed, "track_requests.txt");
@@ -75,10 +136,10 @@ int main(int argc, char *argv[]) {
     int initial_pos = 50;
    
     // Execute each scheduling algorithm and measure performance
-    int fifo_tracks = fifo_scheduler(requests, m, req_info_fifo);
-    int sstf_tracks = sstf_scheduler(requests, m, req_info_sstf);
-    int scan_tracks = scan_scheduler(requests, m, initial_pos, req_info_scan);
-    int cscan_tracks = c_scan_scheduler(requests, m, initial_pos, req_info_cscan);
+    int fifo_tracks = run_scheduler(ALGO_FIFO, requests, m, initial_pos, req_info_fifo);
+    int sstf_tracks = run_scheduler(ALGO_SSTF, requests, m, initial_pos, req_info_sstf);
+    int scan_tracks = run_scheduler(ALGO_SCAN, requests, m, initial_pos, req_info_scan);
+    int cscan_tracks = run_scheduler(ALGO_CSCAN, requests, m, initial_pos, req_info_cscan);
    
     // Print results
     printf("\n=== Disk Scheduling Algorithm Performance ===\n");
@@ -106,6 +167,11 @@ int main(int argc, char *argv[]) {
     printf("\nC-SCAN Delay Histogram:\n");
     print_histogram(req_info_cscan, m);
    
+    // Compare against a multi-actuator drive if requested
+    if (num_actuators > 1) {
+        analyze_actuators(requests, m, num_actuators);
+    }
+   
     // Free allocated memory
     free(requests);
     free(req_info_fifo);
@@ -157,7 +223,8 @@ void generate_requests(int m, int seed, const char *filename) {
  *   - requests: Array to store the track requests
  *   - m: Pointer to store the number of requests
  * 
- * Outputs: Populates the requests array and sets m to the number of requests
+ * Outputs: Populates the requests array and sets m to the number of requests;
+ *          exits if a track is outside 0 to MAX_TRACKS - 1
  */
 void read_requests(const char *filename, int *requests, int *m) {
     FILE *fp;
@@ -176,6 +243,10 @@ void read_requests(const char *filename, int *requests, int *m) {
     // Read each track request
     for (i = 0; i < num_requests; i++) {
         fscanf(fp, "%d", &requests[i]);
+        if (requests[i] < 0 || requests[i] >= MAX_TRACKS) {
+            printf("Track %d in %s is outside 0-%d\n", requests[i], filename, MAX_TRACKS - 1);
+            exit(1);
+        }
     }
    
     fclose(fp);
@@ -695,4 +766,778 @@ void print_histogram(Request *req_info, int m) {
         }
         printf("\n");
     }
-}
\ No newline at end of file
+}
+ 
+/**
+ * Run the reference implementation of one of the scheduling algorithms
+ * These are the original schedulers, kept as oracles for the verify mode.
+ * FIFO and SSTF start at the first request, SCAN and C-SCAN at initial_pos
+ * 
+ * Inputs:
+ *   - algorithm: One of ALGO_FIFO, ALGO_SSTF, ALGO_SCAN or ALGO_CSCAN
+ *   - requests: Array of track numbers requested
+ *   - m: Number of requests
+ *   - initial_pos: Initial position of the disk head
+ *   - req_info: Array to store request processing information
+ * 
+ * Outputs: Total number of tracks traversed by the disk head
+ */
+int run_reference_scheduler(int algorithm, int *requests, int m, int initial_pos, Request *req_info) {
+    switch (algorithm) {
+        case ALGO_FIFO:
+            return fifo_scheduler(requests, m, req_info);
+        case ALGO_SSTF:
+            return sstf_scheduler(requests, m, req_info);
+        case ALGO_SCAN:
+            return scan_scheduler(requests, m, initial_pos, req_info);
+        case ALGO_CSCAN:
+            return c_scan_scheduler(requests, m, initial_pos, req_info);
+    }
+   
+    printf("Unknown scheduling algorithm %d\n", algorithm);
+    exit(1);
+}
+ 
+/**
+ * Check whether C-SCAN jumps back to the start of the disk for a trace
+ * This happens when any request lies below the initial head position.
+ * 
+ * Inputs:
+ *   - requests: Array of track numbers requested
+ *   - m: Number of requests
+ *   - initial_pos: Initial position of the disk head
+ * 
+ * Outputs: true if C-SCAN returns to track 0, false otherwise
+ */
+bool c_scan_wraps(int *requests, int m, int initial_pos) {
+    int i;
+   
+    for (i = 0; i < m; i++) {
+        if (requests[i] < initial_pos) {
+            return true;
+        }
+    }
+    return false;
+}
+ 
+/**
+ * Simulate a drive with several independent actuators
+ * The track space is split into equal contiguous ranges, each request is
+ * routed to the actuator covering its track, and every actuator runs its own
+ * instance of the scheduler starting in the middle of its range. Tracks are
+ * shifted to be relative to the start of the range so that C-SCAN returns to
+ * the first track of its own range instead of track 0.
+ * 
+ * The head movement charged to each actuator includes the seek from the
+ * middle of the range to the first request for FIFO and SSTF, which
+ * otherwise start there for free, and the return seek from the top of the
+ * range to its first track when C-SCAN wraps, which the scheduler does not
+ * count. Like the head stacks of a real multi-actuator drive, each actuator
+ * spreads its range over the full stroke of its own platters, so its
+ * movement is scaled by MAX_TRACKS over the range width before it is turned
+ * into time. Any speedup over a single actuator then comes from actuators
+ * working concurrently rather than from shorter seeks.
+ * 
+ * Inputs:
+ *   - algorithm: Scheduling algorithm run by every actuator
+ *   - requests: Array of track numbers requested
+ *   - m: Number of requests
+ *   - num_actuators: Number of actuators (1 to MAX_ACTUATORS)
+ *   - actuators: Array of num_actuators entries to store per-actuator results
+ * 
+ * Outputs: Populates the actuators array
+ */
+void simulate_actuators(int algorithm, int *requests, int m, int num_actuators, Actuator *actuators) {
+    int a, i;
+    int *local_requests = (int *)malloc(m * sizeof(int));
+    Request *local_info = (Request *)malloc(m * sizeof(Request));
+   
+    if (!local_requests || !local_info) {
+        printf("Memory allocation failed\n");
+        exit(1);
+    }
+   
+    for (a = 0; a < num_actuators; a++) {
+        Actuator *act = &actuators[a];
+        act->low_track = a * MAX_TRACKS / num_actuators;
+        act->high_track = (a + 1) * MAX_TRACKS / num_actuators - 1;
+        act->request_count = 0;
+        act->tracks_traversed = 0;
+        act->stroke_tracks = 0;
+       
+        // Route requests in this actuator's track range, keeping arrival order
+        for (i = 0; i < m; i++) {
+            if (requests[i] >= act->low_track && requests[i] <= act->high_track) {
+                local_requests[act->request_count++] = requests[i] - act->low_track;
+            }
+        }
+       
+        // Idle actuators do not move
+        if (act->request_count > 0) {
+            int initial_pos = (act->high_track - act->low_track + 1) / 2;
+            act->tracks_traversed = run_scheduler(algorithm, local_requests,
+                                                  act->request_count, initial_pos, local_info);
+           
+            // FIFO and SSTF skip the seek to their first request
+            if (algorithm == ALGO_FIFO || algorithm == ALGO_SSTF) {
+                act->tracks_traversed += abs(local_requests[0] - initial_pos);
+            }
+           
+            // C-SCAN does not count its return seek to the start of the range
+            if (algorithm == ALGO_CSCAN &&
+                c_scan_wraps(local_requests, act->request_count, initial_pos)) {
+                act->tracks_traversed += act->high_track - act->low_track;
+            }
+        }
+       
+        // Spread the range over a full stroke of the actuator's platters
+        act->stroke_tracks = (double)act->tracks_traversed * MAX_TRACKS /
+                             (act->high_track - act->low_track + 1);
+        act->busy_ms = act->stroke_tracks * SEEK_MS_PER_TRACK +
+                       act->request_count * REQUEST_OVERHEAD_MS;
+    }
+   
+    free(local_requests);
+    free(local_info);
+}
+ 
+/**
+ * Compare a single-actuator drive with a multi-actuator drive
+ * Actuators work concurrently, so the drive finishes when its busiest
+ * actuator does. Aggregate IOPS is the number of requests divided by that
+ * time, and load imbalance is the busiest actuator's time divided by the
+ * mean actuator time (1.00 means perfectly balanced). Seek time is based on
+ * full-stroke head movement (see simulate_actuators).
+ * 
+ * Inputs:
+ *   - requests: Array of track numbers requested
+ *   - m: Number of requests
+ *   - num_actuators: Number of actuators in the multi-actuator drive
+ * 
+ * Outputs: Prints per-actuator workload and aggregate metrics to standard output
+ */
+void analyze_actuators(int *requests, int m, int num_actuators) {
+    Actuator single[1];
+    Actuator actuators[MAX_ACTUATORS];
+    int algorithm, a;
+   
+    printf("\n=== Multi-Actuator Analysis (%d actuators) ===\n", num_actuators);
+    printf("Service time model: %.2f ms per track + %.2f ms per request\n",
+           SEEK_MS_PER_TRACK, REQUEST_OVERHEAD_MS);
+    printf("Each actuator's tracks span the full stroke of its platters;\n");
+    printf("C-SCAN includes the return seek to the start of the range\n");
+   
+    for (algorithm = 0; algorithm < NUM_ALGORITHMS; algorithm++) {
+        double makespan = 0, total_busy = 0;
+        double single_iops, multi_iops, imbalance;
+       
+        simulate_actuators(algorithm, requests, m, 1, single);
+        simulate_actuators(algorithm, requests, m, num_actuators, actuators);
+       
+        printf("\n%s:\n", algorithm_names[algorithm]);
+        printf("Actuator | Track Range | Requests | Tracks Traversed | Full-Stroke Tracks | Busy Time (ms)\n");
+        printf("---------|-------------|----------|------------------|--------------------|---------------\n");
+       
+        for (a = 0; a < num_actuators; a++) {
+            printf("%-8d | %2d - %2d     | %-8d | %-16d | %-18.1f | %.2f\n",
+                   a, actuators[a].low_track, actuators[a].high_track,
+                   actuators[a].request_count, actuators[a].tracks_traversed,
+                   actuators[a].stroke_tracks, actuators[a].busy_ms);
+           
+            total_busy += actuators[a].busy_ms;
+            if (actuators[a].busy_ms > makespan) {
+                makespan = actuators[a].busy_ms;
+            }
+        }
+       
+        single_iops = single[0].busy_ms > 0 ? m / (single[0].busy_ms / 1000) : 0;
+        multi_iops = makespan > 0 ? m / (makespan / 1000) : 0;
+        imbalance = total_busy > 0 ? makespan / (total_busy / num_actuators) : 1;
+       
+        printf("Single actuator: %.2f ms, %.2f IOPS\n", single[0].busy_ms, single_iops);
+        printf("%d actuators: %.2f ms, %.2f IOPS (%.2fx)\n", num_actuators, makespan,
+               multi_iops, single_iops > 0 ? multi_iops / single_iops : 0);
+        printf("Load imbalance (max/mean busy time): %.2f\n", imbalance);
+    }
+}
+ 
+/**
+ * Check that every request is for a track on the disk
+ * 
+ * Inputs:
+ *   - requests: Array of track numbers requested
+ *   - m: Number of requests
+ * 
+ * Outputs: true if every track is between 0 and MAX_TRACKS - 1, false otherwise
+ */
+bool tracks_in_range(int *requests, int m) {
+    int i;
+   
+    for (i = 0; i < m; i++) {
+        if (requests[i] < 0 || requests[i] >= MAX_TRACKS) {
+            return false;
+        }
+    }
+    return true;
+}
+ 
+/**
+ * Group request indices by track using a counting sort
+ * Indices on the same track keep their arrival order, matching the stable
+ * ordering of the reference schedulers. Every track must be between 0 and
+ * MAX_TRACKS - 1 (see tracks_in_range).
+ * 
+ * Inputs:
+ *   - requests: Array of track numbers requested
+ *   - m: Number of requests
+ *   - start: Array of MAX_TRACKS + 1 entries; start[t] to start[t+1] - 1 is
+ *            the range of by_track holding the requests for track t
+ *   - by_track: Array of m entries to store request indices grouped by track
+ * 
+ * Outputs: Populates the start and by_track arrays
+ */
+void group_by_track(int *requests, int m, int *start, int *by_track) {
+    int i;
+    int next[MAX_TRACKS];
+   
+    for (i = 0; i <= MAX_TRACKS; i++) {
+        start[i] = 0;
+    }
+    for (i = 0; i < m; i++) {
+        start[requests[i] + 1]++;
+    }
+    for (i = 0; i < MAX_TRACKS; i++) {
+        start[i + 1] += start[i];
+        next[i] = start[i];
+    }
+    for (i = 0; i < m; i++) {
+        by_track[next[requests[i]]++] = i;
+    }
+}
+ 
+/**
+ * Fill in request processing information from a service order
+ * 
+ * Inputs:
+ *   - requests: Array of track numbers requested
+ *   - m: Number of requests
+ *   - service_order: Request indices in the order they were serviced
+ *   - req_info: Array to store request processing information
+ * 
+ * Outputs: Populates the req_info array
+ */
+void record_service_order(int *requests, int m, int *service_order, Request *req_info) {
+    int i;
+   
+    for (i = 0; i < m; i++) {
+        req_info[i].track = requests[i];
+        req_info[i].entry_order = i;
+    }
+    for (i = 0; i < m; i++) {
+        int idx = service_order[i];
+        req_info[idx].service_order = i;
+        req_info[idx].delay = req_info[idx].service_order - req_info[idx].entry_order;
+    }
+}
+ 
+/**
+ * SSTF scheduler that searches outward from the head over per-track queues
+ * instead of scanning every request, giving the same service order as
+ * sstf_scheduler (ties go to the request that arrived first)
+ * 
+ * Inputs:
+ *   - requests: Array of track numbers requested
+ *   - m: Number of requests
+ *   - req_info: Array to store request processing information
+ * 
+ * Outputs: Total number of tracks traversed by the disk head
+ */
+int sstf_fast_scheduler(int *requests, int m, Request *req_info) {
+    int i;
+    int start[MAX_TRACKS + 1];
+    int next[MAX_TRACKS];  // Earliest unserviced request in each track's group
+    int current_pos = requests[0];  // Start at the first request
+    int total_movement = 0;
+    int *by_track = (int *)malloc(m * sizeof(int));
+    int *service_order = (int *)malloc(m * sizeof(int));
+   
+    if (!by_track || !service_order) {
+        printf("Memory allocation failed\n");
+        exit(1);
+    }
+   
+    group_by_track(requests, m, start, by_track);
+    for (i = 0; i < MAX_TRACKS; i++) {
+        next[i] = start[i];
+    }
+   
+    // First request is served immediately; it is the earliest on its track
+    service_order[0] = 0;
+    next[current_pos]++;
+   
+    for (i = 1; i < m; i++) {
+        int distance = 0;
+        int below = -1, above = -1;  // Closest waiting request on each side
+   
+        while (below < 0 && above < 0) {
+            int low = current_pos - distance, high = current_pos + distance;
+            if (low >= 0 && next[low] < start[low + 1]) {
+                below = by_track[next[low]];
+            }
+            if (high < MAX_TRACKS && next[high] < start[high + 1]) {
+                above = by_track[next[high]];
+            }
+            distance++;
+        }
+   
+        // Ties between both sides go to whichever request arrived first
+        int next_index = (above < 0 || (below >= 0 && below < above)) ? below : above;
+        service_order[i] = next_index;
+        total_movement += distance - 1;
+        current_pos = requests[next_index];
+        next[current_pos]++;
+    }
+   
+    record_service_order(requests, m, service_order, req_info);
+   
+    free(by_track);
+    free(service_order);
+   
+    return total_movement;
+}
+ 
+/**
+ * SCAN scheduler that walks the tracks in sweep order over per-track queues
+ * instead of bubble sorting each sweep, giving the same service order as
+ * scan_scheduler
+ * 
+ * Inputs:
+ *   - requests: Array of track numbers requested
+ *   - m: Number of requests
+ *   - initial_pos: Initial position of the disk head
+ *   - req_info: Array to store request processing information
+ * 
+ * Outputs: Total number of tracks traversed by the disk head
+ */
+int scan_fast_scheduler(int *requests, int m, int initial_pos, Request *req_info) {
+    int i, t;
+    int start[MAX_TRACKS + 1];
+    int current_pos = initial_pos;
+    int total_movement = 0;
+    int serviced_count = 0;
+    int *by_track = (int *)malloc(m * sizeof(int));
+    int *service_order = (int *)malloc(m * sizeof(int));
+   
+    if (!by_track || !service_order) {
+        printf("Memory allocation failed\n");
+        exit(1);
+    }
+   
+    group_by_track(requests, m, start, by_track);
+   
+    // Sweep up from the initial position, then down over everything below it
+    for (t = initial_pos; t < MAX_TRACKS; t++) {
+        for (i = start[t]; i < start[t + 1]; i++) {
+            total_movement += t - current_pos;
+            current_pos = t;
+            service_order[serviced_count++] = by_track[i];
+        }
+    }
+    for (t = initial_pos - 1; t >= 0; t--) {
+        for (i = start[t]; i < start[t + 1]; i++) {
+            total_movement += current_pos - t;
+            current_pos = t;
+            service_order[serviced_count++] = by_track[i];
+        }
+    }
+   
+    record_service_order(requests, m, service_order, req_info);
+   
+    free(by_track);
+    free(service_order);
+   
+    return total_movement;
+}
+ 
+/**
+ * C-SCAN scheduler that walks the tracks in sweep order over per-track
+ * queues instead of bubble sorting each sweep, giving the same service
+ * order as c_scan_scheduler
+ * 
+ * Inputs:
+ *   - requests: Array of track numbers requested
+ *   - m: Number of requests
+ *   - initial_pos: Initial position of the disk head
+ *   - req_info: Array to store request processing information
+ * 
+ * Outputs: Total number of tracks traversed by the disk head
+ */
+int c_scan_fast_scheduler(int *requests, int m, int initial_pos, Request *req_info) {
+    int i, t;
+    int start[MAX_TRACKS + 1];
+    int current_pos = initial_pos;
+    int total_movement = 0;
+    int serviced_count = 0;
+    int *by_track = (int *)malloc(m * sizeof(int));
+    int *service_order = (int *)malloc(m * sizeof(int));
+   
+    if (!by_track || !service_order) {
+        printf("Memory allocation failed\n");
+        exit(1);
+    }
+   
+    group_by_track(requests, m, start, by_track);
+   
+    // Sweep up from the initial position
+    for (t = initial_pos; t < MAX_TRACKS; t++) {
+        for (i = start[t]; i < start[t + 1]; i++) {
+            total_movement += t - current_pos;
+            current_pos = t;
+            service_order[serviced_count++] = by_track[i];
+        }
+    }
+   
+    // Jump back to track 0 without counting the movement and sweep up again
+    if (serviced_count < m) {
+        current_pos = 0;
+        for (t = 0; t < initial_pos; t++) {
+            for (i = start[t]; i < start[t + 1]; i++) {
+                total_movement += t - current_pos;
+                current_pos = t;
+                service_order[serviced_count++] = by_track[i];
+            }
+        }
+    }
+   
+    record_service_order(requests, m, service_order, req_info);
+   
+    free(by_track);
+    free(service_order);
+   
+    return total_movement;
+}
+ 
+/**
+ * Run one of the scheduling algorithms selected by its identifier
+ * SSTF, SCAN and C-SCAN use the per-track queue versions; FIFO is already
+ * linear. The per-track queues only cover tracks 0 to MAX_TRACKS - 1, so a
+ * trace or head position outside the disk falls back to the reference
+ * implementation. FIFO and SSTF start at the first request, SCAN and C-SCAN
+ * at initial_pos.
+ * 
+ * Inputs:
+ *   - algorithm: One of ALGO_FIFO, ALGO_SSTF, ALGO_SCAN or ALGO_CSCAN
+ *   - requests: Array of track numbers requested
+ *   - m: Number of requests
+ *   - initial_pos: Initial position of the disk head
+ *   - req_info: Array to store request processing information
+ * 
+ * Outputs: Total number of tracks traversed by the disk head
+ */
+int run_scheduler(int algorithm, int *requests, int m, int initial_pos, Request *req_info) {
+    if (!tracks_in_range(requests, m) || initial_pos < 0 || initial_pos >= MAX_TRACKS) {
+        return run_reference_scheduler(algorithm, requests, m, initial_pos, req_info);
+    }
+   
+    switch (algorithm) {
+        case ALGO_FIFO:
+            return fifo_scheduler(requests, m, req_info);
+        case ALGO_SSTF:
+            return sstf_fast_scheduler(requests, m, req_info);
+        case ALGO_SCAN:
+            return scan_fast_scheduler(requests, m, initial_pos, req_info);
+        case ALGO_CSCAN:
+            return c_scan_fast_scheduler(requests, m, initial_pos, req_info);
+    }
+   
+    printf("Unknown scheduling algorithm %d\n", algorithm);
+    exit(1);
+}
+ 
+/**
+ * Compare a fast scheduler with the reference implementation on one trace
+ * The reference schedulers are the oracles: the fast version must report
+ * the same total movement and give every request the same service order
+ * and delay.
+ * 
+ * Inputs:
+ *   - algorithm: One of ALGO_FIFO, ALGO_SSTF, ALGO_SCAN or ALGO_CSCAN
+ *   - requests: Array of track numbers requested
+ *   - m: Number of requests (1 to MAX_REQUESTS)
+ *   - initial_pos: Initial position of the disk head
+ * 
+ * Outputs: Number of failed checks, each failure is printed to standard output
+ */
+int compare_engines(int algorithm, int *requests, int m, int initial_pos) {
+    int i;
+    int failures = 0;
+    int *input = (int *)malloc(m * sizeof(int));
+    Request *expected = (Request *)malloc(m * sizeof(Request));
+    Request *actual = (Request *)malloc(m * sizeof(Request));
+   
+    if (!input || !expected || !actual) {
+        printf("Memory allocation failed\n");
+        exit(1);
+    }
+   
+    memcpy(input, requests, m * sizeof(int));
+    int expected_tracks = run_reference_scheduler(algorithm, input, m, initial_pos, expected);
+    memcpy(input, requests, m * sizeof(int));
+    int actual_tracks = run_scheduler(algorithm, input, m, initial_pos, actual);
+   
+    if (actual_tracks != expected_tracks) {
+        printf("%s (m=%d, head=%d): fast version traversed %d tracks, reference %d\n",
+               algorithm_names[algorithm], m, initial_pos, actual_tracks, expected_tracks);
+        failures++;
+    }
+   
+    for (i = 0; i < m; i++) {
+        if (actual[i].track != expected[i].track ||
+            actual[i].entry_order != expected[i].entry_order ||
+            actual[i].service_order != expected[i].service_order ||
+            actual[i].delay != expected[i].delay) {
+            printf("%s (m=%d, head=%d): request %d serviced at %d (delay %d) by fast version, "
+                   "at %d (delay %d) by reference\n",
+                   algorithm_names[algorithm], m, initial_pos, i,
+                   actual[i].service_order, actual[i].delay,
+                   expected[i].service_order, expected[i].delay);
+            failures++;
+            break;
+        }
+    }
+   
+    free(input);
+    free(expected);
+    free(actual);
+   
+    return failures;
+}
+ 
+/**
+ * Run one scheduler as the simulation does and check its output
+ * Verifies that every request is serviced exactly once, that track, entry
+ * order and delay are consistent, that the reported movement matches the
+ * service order, that SSTF always picks a nearest track, and that the
+ * scheduler is deterministic and leaves its input unchanged. The fast
+ * version must then match the reference exactly (see compare_engines), and
+ * with the default initial position the single-actuator path of
+ * simulate_actuators() must agree as well.
+ * 
+ * Inputs:
+ *   - algorithm: One of ALGO_FIFO, ALGO_SSTF, ALGO_SCAN or ALGO_CSCAN
+ *   - requests: Array of track numbers requested
+ *   - m: Number of requests (1 to MAX_REQUESTS)
+ *   - initial_pos: Initial position of the disk head
+ * 
+ * Outputs: Number of failed checks, each failure is printed to standard output
+ */
+int check_schedule(int algorithm, int *requests, int m, int initial_pos) {
+    int i, j;
+    int failures = 0;
+    int *input = (int *)malloc(m * sizeof(int));
+    int *order = (int *)malloc(m * sizeof(int));
+    Request *req_info = (Request *)malloc(m * sizeof(Request));
+    Request *rerun_info = (Request *)malloc(m * sizeof(Request));
+   
+    if (!input || !order || !req_info || !rerun_info) {
+        printf("Memory allocation failed\n");
+        exit(1);
+    }
+   
+    memcpy(input, requests, m * sizeof(int));
+    for (i = 0; i < m; i++) {
+        order[i] = -1;
+    }
+   
+    int tracks = run_scheduler(algorithm, input, m, initial_pos, req_info);
+   
+    // Every request must be serviced exactly once with consistent bookkeeping
+    for (i = 0; i < m; i++) {
+        int service = req_info[i].service_order;
+        if (req_info[i].track != requests[i] || req_info[i].entry_order != i ||
+            req_info[i].delay != service - i ||
+            service < 0 || service >= m || order[service] != -1) {
+            printf("%s (m=%d, head=%d): bad request info for request %d\n",
+                   algorithm_names[algorithm], m, initial_pos, i);
+            failures++;
+            break;
+        }
+        order[service] = i;
+    }
+   
+    if (failures == 0) {
+        // Replay the service order and recount the head movement
+        int current_pos = (algorithm == ALGO_SCAN || algorithm == ALGO_CSCAN)
+                          ? initial_pos : requests[order[0]];
+        int replayed = 0;
+       
+        if (algorithm != ALGO_SCAN && algorithm != ALGO_CSCAN && order[0] != 0) {
+            printf("%s (m=%d, head=%d): first request not serviced first\n",
+                   algorithm_names[algorithm], m, initial_pos);
+            failures++;
+        }
+       
+        for (i = 0; i < m; i++) {
+            int track = requests[order[i]];
+           
+            // C-SCAN jumps back to track 0 without counting the movement
+            if (algorithm == ALGO_CSCAN && track < current_pos) {
+                current_pos = 0;
+            }
+           
+            // SSTF must never skip a closer unserviced request
+            if (algorithm == ALGO_SSTF && i > 0) {
+                for (j = i + 1; j < m; j++) {
+                    if (abs(requests[order[j]] - current_pos) < abs(track - current_pos)) {
+                        printf("SSTF (m=%d): request %d serviced before closer request %d\n",
+                               m, order[i], order[j]);
+                        failures++;
+                        break;
+                    }
+                }
+            }
+           
+            replayed += abs(track - current_pos);
+            current_pos = track;
+        }
+       
+        if (replayed != tracks) {
+            printf("%s (m=%d, head=%d): reported %d tracks but service order traverses %d\n",
+                   algorithm_names[algorithm], m, initial_pos, tracks, replayed);
+            failures++;
+        }
+    }
+   
+    // Running again must give the same result and must not modify the input
+    int rerun_tracks = run_scheduler(algorithm, input, m, initial_pos, rerun_info);
+    if (memcmp(input, requests, m * sizeof(int)) != 0 || rerun_tracks != tracks) {
+        printf("%s (m=%d, head=%d): scheduler modified its input or is not deterministic\n",
+               algorithm_names[algorithm], m, initial_pos);
+        failures++;
+    } else {
+        for (i = 0; i < m; i++) {
+            if (rerun_info[i].service_order != req_info[i].service_order ||
+                rerun_info[i].delay != req_info[i].delay) {
+                printf("%s (m=%d, head=%d): service order differs between runs\n",
+                       algorithm_names[algorithm], m, initial_pos);
+                failures++;
+                break;
+            }
+        }
+    }
+   
+    // The fast version must match the reference exactly
+    failures += compare_engines(algorithm, requests, m, initial_pos);
+   
+    // A single actuator covering every track must match the direct call,
+    // plus the seek from the middle of the disk that FIFO and SSTF skip and
+    // the return seek that C-SCAN does not count
+    if (initial_pos == MAX_TRACKS / 2) {
+        Actuator single[1];
+        int direct = tracks;
+        if (algorithm == ALGO_FIFO || algorithm == ALGO_SSTF) {
+            direct += abs(requests[0] - initial_pos);
+        }
+        if (algorithm == ALGO_CSCAN && c_scan_wraps(requests, m, initial_pos)) {
+            direct += MAX_TRACKS - 1;
+        }
+        simulate_actuators(algorithm, requests, m, 1, single);
+        if (single[0].request_count != m || single[0].tracks_traversed != direct) {
+            printf("%s (m=%d): single actuator traversed %d tracks, expected %d\n",
+                   algorithm_names[algorithm], m, single[0].tracks_traversed, direct);
+            failures++;
+        }
+    }
+   
+    free(input);
+    free(order);
+    free(req_info);
+    free(rerun_info);
+   
+    return failures;
+}
+ 
+/**
+ * Self-check every scheduling algorithm against edge cases and random traces
+ * Edge cases cover a single request, all requests on one track, requests at
+ * the first and last track, the head at either end of the disk (SCAN and
+ * C-SCAN only, since FIFO and SSTF ignore it) and tracks outside the disk,
+ * which must fall back to the reference schedulers. Random traces vary in
+ * length up to 999 requests, and the largest input is always included. The
+ * limit comes from the reference SCAN and C-SCAN, whose sweep buffers are
+ * fixed arrays of MAX_REQUESTS entries; the fast versions have no such
+ * limit, but larger traces could not be compared against the oracles.
+ * 
+ * Inputs:
+ *   - seed: Random seed value for reproducible traces
+ *   - trials: Number of random traces to check
+ * 
+ * Outputs: Number of failed checks; prints a summary to standard output
+ */
+int verify_schedulers(int seed, int trials) {
+    int requests[MAX_REQUESTS];
+    int largest = MAX_REQUESTS - 1;  // Largest trace the reference schedulers handle
+    int heads[3] = {MAX_TRACKS / 2, 0, MAX_TRACKS - 1};
+    int edge_tracks[3] = {0, MAX_TRACKS / 2, MAX_TRACKS - 1};
+    int sizes[4] = {1, 2, 10, largest};
+    int algorithm, h, s, t, i;
+    int cases = 0, failures = 0;
+   
+    printf("Verifying schedulers with seed %d and %d random traces\n", seed, trials);
+    srand(seed);
+   
+    for (algorithm = 0; algorithm < NUM_ALGORITHMS; algorithm++) {
+        // FIFO and SSTF ignore the head position, so one is enough
+        int head_count = (algorithm == ALGO_SCAN || algorithm == ALGO_CSCAN) ? 3 : 1;
+       
+        for (h = 0; h < head_count; h++) {
+            for (s = 0; s < 4; s++) {
+                int m = sizes[s];
+               
+                // All requests on the same track, at both ends and in the middle
+                for (t = 0; t < 3; t++) {
+                    for (i = 0; i < m; i++) {
+                        requests[i] = edge_tracks[t];
+                    }
+                    failures += check_schedule(algorithm, requests, m, heads[h]);
+                    cases++;
+                }
+               
+                // Alternating between the first and last track
+                for (i = 0; i < m; i++) {
+                    requests[i] = (i % 2 == 0) ? 0 : MAX_TRACKS - 1;
+                }
+                failures += check_schedule(algorithm, requests, m, heads[h]);
+                cases++;
+            }
+        }
+       
+        // Tracks outside the disk, which only the reference schedulers handle
+        for (i = 0; i < 10; i++) {
+            requests[i] = (i % 3 == 0) ? -7 * i - 1 : (i % 3 == 1) ? MAX_TRACKS + 20 * i : 10 * i;
+        }
+        failures += compare_engines(algorithm, requests, 10, MAX_TRACKS / 2);
+        cases++;
+    }
+   
+    // Random traces with random lengths and head positions
+    for (t = 0; t < trials; t++) {
+        int m = (t == 0) ? largest : rand() % largest + 1;
+        int head = rand() % MAX_TRACKS;
+       
+        for (i = 0; i < m; i++) {
+            requests[i] = rand() % MAX_TRACKS;
+        }
+        for (algorithm = 0; algorithm < NUM_ALGORITHMS; algorithm++) {
+            failures += check_schedule(algorithm, requests, m, MAX_TRACKS / 2);
+            cases++;
+            if (algorithm == ALGO_SCAN || algorithm == ALGO_CSCAN) {
+                failures += check_schedule(algorithm, requests, m, head);
+                cases++;
+            }
+        }
+    }
+   
+    printf("%d cases checked, %d failures\n", cases, failures);
+    return failures;
+}